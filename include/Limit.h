@@ -4,14 +4,18 @@
 
 struct Limit {
     Price price;
-    Quantity totalVolume = 0;
-    uint32_t orderCount = 0;
+    Quantity totalVolume = 0;   // ɼҵ / L2 ֻչʾһ֣
+    Quantity hiddenVolume = 0;  // ɽش
+    uint32_t orderCount = 0;    // ϵĶδժĹ
+    uint32_t deadCount = 0;     // ѳδժĶ
     Order* head = nullptr;
     Order* tail = nullptr;
 
-    Limit() : price(0), totalVolume(0), orderCount(0), head(nullptr), tail(nullptr) {}
-    Limit(Price p) : price(p), totalVolume(0), orderCount(0), head(nullptr), tail(nullptr) {}
+    Limit() : price(0), totalVolume(0), hiddenVolume(0), orderCount(0), deadCount(0), head(nullptr), tail(nullptr) {}
+    Limit(Price p) : price(p), totalVolume(0), hiddenVolume(0), orderCount(0), deadCount(0), head(nullptr), tail(nullptr) {}
 };
 
 void addOrderToLimit(Limit& limit, Order* order);
-void removeOrderFromLimit(Limit& limit, Order* order);
\ No newline at end of file
+void removeOrderFromLimit(Limit& limit, Order* order);
+void moveOrderToTail(Limit& limit, Order* order);
+void replenishOrder(Limit& limit, Order* order);
\ No newline at end of file
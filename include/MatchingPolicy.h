@@ -0,0 +1,126 @@
+#pragma once
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include "Limit.h"
+#include "Order.h"
+#include "Types.h"
+
+// 㷨 OrderBook ʱѡÿֻһ
+enum class MatchingAlgorithm : uint8_t {
+    Fifo,            // ۸-ʱ
+    ProRata,         // ҵ
+    TopOrderProRata  // ׶ȳɽʣಿְ
+};
+
+// --- ԣھ͡ɽ ---
+
+// Ϊ Takeṛ۸
+struct BuySide {
+    using PartnerMap = std::map<Price, Limit*, std::less<Price>>;
+    static constexpr Side takerSide = Side::Buy;
+
+    // 򵥼۸ >= ͼ۲ܳɽ
+    static bool crosses(Price takerPrice, Price makerPrice) { return takerPrice >= makerPrice; }
+};
+
+// Ϊ Takeṛ۸
+struct SellSide {
+    using PartnerMap = std::map<Price, Limit*, std::greater<Price>>;
+    static constexpr Side takerSide = Side::Sell;
+
+    // ۸ <= ߼۲ܳɽ
+    static bool crosses(Price takerPrice, Price makerPrice) { return takerPrice <= makerPrice; }
+};
+
+// ʱõʱ·Ϸڴ
+struct AllocationScratch {
+    std::vector<Order*> orders;
+    std::vector<Quantity> quantities;
+    std::vector<Quantity> allocations;
+};
+
+// --- ԣһ۸λΰ incoming ָ Maker ---
+// fill(maker, qty) ɳɽر Maker Ƴ / ɽˢ£
+// Եǰȼ maker->next
+
+// ۸-ʱȣӶγԵ
+struct FifoAllocation {
+    template<typename FillFn>
+    static void allocate(Limit& limit, Quantity incoming, AllocationScratch&, FillFn&& fill) {
+        Order* curr = limit.head;
+        while (curr && incoming > 0) {
+            Order* next = curr->next;
+            Quantity matchQty = std::min(incoming, curr->quantity);
+            incoming -= matchQty;
+            fill(curr, matchQty);
+            curr = next;
+        }
+    }
+};
+
+// 䣺alloc_i = floor(q_i * incoming / total)
+// µͷȻڶʱÿ 1 ֣ȫȷ
+struct ProRataAllocation {
+    template<typename FillFn>
+    static void allocate(Limit& limit, Quantity incoming, AllocationScratch& scratch, FillFn&& fill) {
+        // ܰԹʱ FIFO ȼ
+        if (incoming >= limit.totalVolume) {
+            FifoAllocation::allocate(limit, incoming, scratch, fill);
+            return;
+        }
+
+        // 1. ϵռ
+        scratch.orders.clear();
+        scratch.quantities.clear();
+        for (Order* curr = limit.head; curr; curr = curr->next) {
+            scratch.orders.push_back(curr);
+            scratch.quantities.push_back(curr->quantity);
+        }
+
+        const size_t n = scratch.quantities.size();
+        scratch.allocations.resize(n);
+        const Quantity* qty = scratch.quantities.data();
+        Quantity* alloc = scratch.allocations.data();
+
+        // 2. һ޷֧ɨȡķݶ
+        //     32.32 ƣֻ㡢 1˷ȷȫûԪس
+        const uint32_t total = limit.totalVolume;
+        const uint32_t ratio = static_cast<uint32_t>((static_cast<uint64_t>(incoming) << 32) / total);
+
+        uint64_t allocated = 0;
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t a = static_cast<uint32_t>((static_cast<uint64_t>(qty[i]) * ratio) >> 32);
+            a += (static_cast<uint64_t>(a + 1) * total <= static_cast<uint64_t>(qty[i]) * incoming) ? 1 : 0;
+            alloc[i] = a;
+            allocated += a;
+        }
+
+        // 3. ͷ˳򲹸ǰ residual incoming < total ʱ alloc_i < q_i 
+        const size_t residual = static_cast<size_t>(incoming - allocated);
+        for (size_t i = 0; i < n; ++i) alloc[i] += (i < residual) ? 1 : 0;
+
+        // 4. ˳ִгɽ
+        for (size_t i = 0; i < n; ++i) {
+            if (alloc[i] > 0) fill(scratch.orders[i], alloc[i]);
+        }
+    }
+};
+
+//  + 䣺׶Ȱ FIFO ɽʣٰ
+struct TopOrderProRataAllocation {
+    template<typename FillFn>
+    static void allocate(Limit& limit, Quantity incoming, AllocationScratch& scratch, FillFn&& fill) {
+        Order* top = limit.head;
+        if (top) {
+            Quantity matchQty = std::min(incoming, top->quantity);
+            incoming -= matchQty;
+            fill(top, matchQty);
+        }
+
+        if (incoming > 0 && limit.head) {
+            ProRataAllocation::allocate(limit, incoming, scratch, fill);
+        }
+    }
+};
\ No newline at end of file
@@ -1,9 +1,14 @@
 #pragma once
 #include <vector>
-#include <mutex>
+#include <thread>
+#include <cassert>
 #include <atomic>
 #include <memory>
 
+// ߶أ
+// - acquire ̵ֻ߳ãRelease ²飬߳ acquire ݾ
+// - release ̵߳ã߳Զ
+//  ThreadSafe ָֻ̻߳ǰȫġ
 template<typename T>
 class ThreadSafeObjectPool {
 private:
@@ -12,17 +17,21 @@ private:
         Node* next;
     };
 
-    // ȫִӣֲ߳̾Ӳʱŷ
-    std::atomic<Node*> globalFreeList{ nullptr };
+    // ̣̣߳߳ؿֻʣ / նͨд
+    std::thread::id owner;
+    Node* localFreeList = nullptr;
 
-    // ڴ
+    // ̻߳յĽڵѹߵߣռб뱾α
+    alignas(64) std::atomic<Node*> remoteFreeList{ nullptr };
+
+    // ڴֻ̻߳ݣ
     std::vector<std::unique_ptr<Node[]>> chunks;
-    std::mutex chunkMutex;
 
     size_t chunkSize;
 
 public:
-    ThreadSafeObjectPool(size_t initialSize = 10000) : chunkSize(initialSize) {
+    ThreadSafeObjectPool(size_t initialSize = 10000)
+        : owner(std::this_thread::get_id()), chunkSize(initialSize) {
         expand();
     }
 
@@ -30,49 +39,62 @@ public:
     ThreadSafeObjectPool(const ThreadSafeObjectPool&) = delete;
     ThreadSafeObjectPool& operator=(const ThreadSafeObjectPool&) = delete;
 
+    // Ȩǰ̣߳һ̹߳졢һ̴߳ʱã
+    // owner ͨԶ release Ტȡֻ߳̿ʼ֮ǰá
+    void bindToCurrentThread() {
+        owner = std::this_thread::get_id();
+    }
+
+    // ̵ֻ߳
     T* acquire() {
-        // Դȫеһڵ
-        Node* oldHead = globalFreeList.load(std::memory_order_relaxed);
-        while (oldHead && !globalFreeList.compare_exchange_weak(oldHead, oldHead->next,
-            std::memory_order_release,
-            std::memory_order_relaxed));
+        assert(std::this_thread::get_id() == owner);
 
-        if (!oldHead) {
-            expand(); // ȫҲˣ
-            return acquire();
+        if (!localFreeList) {
+            // ˣһ԰̻߳յĽڵȫȡ
+            localFreeList = remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+            if (!localFreeList) expand(); // ԶҲˣ
         }
 
+        Node* node = localFreeList;
+        localFreeList = node->next;
+
         // ʹ Placement New ڴϵù캯
-        return new (&oldHead->data) T();
+        return new (&node->data) T();
     }
 
+    // ̶߳Ի
     void release(T* obj) {
         if (!obj) return;
 
         // ֶͷڴ
         obj->~T();
 
-        // ʵNodeָ룩ѹȫ
+        // ʵNodeָ룩ѹؿ
         Node* node = reinterpret_cast<Node*>(obj);
-        node->next = globalFreeList.load(std::memory_order_relaxed);
-        while (!globalFreeList.compare_exchange_weak(node->next, node,
+        if (std::this_thread::get_id() == owner) {
+            node->next = localFreeList;
+            localFreeList = node;
+            return;
+        }
+
+        // ̣߳ѹԶȡߣ ABA ⣩
+        node->next = remoteFreeList.load(std::memory_order_relaxed);
+        while (!remoteFreeList.compare_exchange_weak(node->next, node,
             std::memory_order_release,
             std::memory_order_relaxed));
     }
 
 private:
     void expand() {
-        std::lock_guard<std::mutex> lock(chunkMutex);
-
         auto newChunk = std::make_unique<Node[]>(chunkSize);
         for (size_t i = 0; i < chunkSize - 1; ++i) {
             newChunk[i].next = &newChunk[i + 1];
         }
 
-        // ¿һڵָǰȫͷ
-        newChunk[chunkSize - 1].next = globalFreeList.load();
-        // ȫͷ
-        globalFreeList.store(&newChunk[0]);
+        // ¿һڵָǰıͷ
+        newChunk[chunkSize - 1].next = localFreeList;
+        // ±ͷ
+        localFreeList = &newChunk[0];
 
         chunks.push_back(std::move(newChunk));
     }
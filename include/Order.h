@@ -1,6 +1,8 @@
 #pragma once
 #include "Types.h"  
 
+struct Limit;
+
 struct Order {
     OrderId id;
     Side side;
@@ -9,4 +11,10 @@ struct Order {
     // ˫пƶ
     Order* next = nullptr;
     Order* prev = nullptr;
+    // ɽÿչʾ0 ʾͨصĴ
+    Quantity displayQuantity = 0;
+    Quantity hiddenQuantity = 0;
+    // ӳٳĹڵλʱٲ bids / asks
+    bool dead = false;
+    Limit* limit = nullptr;
 };
\ No newline at end of file
@@ -4,20 +4,33 @@
 #include "Limit.h"
 #include "Order.h"
 #include "ObjectPool.h"
+#include "MatchingPolicy.h"
 #include "Types.h"
 #include <functional>
 
+// Ͼĳֵĳɽֻ IDԽ׶βٷʶ
+struct AuctionFill {
+    OrderId id;
+    Quantity quantity;
+};
+
 // ص
 using TradeCallback = std::function<void(const TradeReport&)>;
+using BookEventCallback = std::function<void(const BookEvent&)>;
 
 class OrderBook {
 private:
     // --- ڴضڴ ---
     // Ԥ㹻Ŀռ䣬 10 
+    // ڴֻһ̣߳µ /  / Ͻӿڶͬһ̵߳
     ThreadSafeObjectPool<Order> orderPool;
     ThreadSafeObjectPool<Limit> limitPool;
 
     TradeCallback tradeCallback; // 洢ص
+    BookEventCallback bookEventCallback; // ҵ / ¼صĬϲ
+
+    MatchingAlgorithm algorithm;           // ʹõĴ㷨
+    AllocationScratch allocationScratch;   // ĸû
 
     // ̣۸
     std::map<Price, Limit*> asks;
@@ -25,16 +38,31 @@ private:
     // ̣۸
     std::map<Price, Limit*, std::greater<Price>> bids;
 
-    // ȫֶ
+    // ȫֶӳٳģʽĹժǰУ
     std::unordered_map<OrderId, Order*> orderIndex;
 
+    // --- ӳٳ ---
+    bool lazyCancel = false;
+    uint32_t compactionThreshold = 1024; // ۼƶٸĹ / յλ󴥷һѹ
+    uint32_t pendingCompaction = 0;
+    size_t deadOrderCount = 0;
+
+    // --- Ͼ ---
+    bool auctionMode = false;
+    std::vector<AuctionFill> auctionBidFills;
+    std::vector<AuctionFill> auctionAskFills;
+    std::vector<Order*> auctionFilledOrders; // ȫɽȴյĶ
+
 public:
-    OrderBook();
+    explicit OrderBook(MatchingAlgorithm algorithm = MatchingAlgorithm::Fifo);
     ~OrderBook();
 
     // ĴϽӿ
     OrderId addOrder(Side side, Price price, Quantity quantity);
 
+    // ɽӿڣÿֻչʾ displayQuantityΪش
+    OrderId addIcebergOrder(Side side, Price price, Quantity quantity, Quantity displayQuantity);
+
     // ӿ
     void cancelOrder(OrderId orderId);
 
@@ -42,6 +70,9 @@ public:
     size_t getOrderCount() const;
     bool hasLimit(Side side, Price price) const;
     Quantity getVolumeAtPrice(Side side, Price price) const;
+    Quantity getHiddenVolumeAtPrice(Side side, Price price) const;
+    // ۸λӳٳģʽ±Ŀյλ
+    size_t getLevelCount(Side side) const;
 
     // ȡ̿ڿգdepth ĬΪ 5
     MarketSnapshot getSnapshot(int depth = 5) const;
@@ -49,12 +80,65 @@ public:
     // ִм۵ʵʳɽ
     Quantity addMarketOrder(Side side, Quantity quantity);
 
+    // ӳٳģʽֻĹժƳٵϾѹʱ
+    // յλһѹⷴ limitPool 
+    void setLazyCancel(bool enabled, uint32_t threshold = 1024);
+
+    // ѹժĹͷſյλ
+    void compact();
+
+    // Ͼۣ¶ֻҵϣ̿ڽ
+    void startAuction();
+    bool isInAuction() const { return auctionMode; }
+
+    // ο۸񣨲ɽreferencePrice Ϊ 0 ʱȡе
+    AuctionResult getIndicativeUncross(Price referencePrice = 0) const;
+
+    // Ծ۸һԳɽпɳɽص
+    AuctionResult uncross(Price referencePrice = 0);
+
+    // ڴعڹ̴̣߳߳ʱڴ̵߳һΣ
+    // Ҫκ̻߳ն֮ǰãÿλնԶ CAS ·
+    void bindToCurrentThread() {
+        orderPool.bindToCurrentThread();
+        limitPool.bindToCurrentThread();
+    }
+
     // ûصӿ
     void setTradeCallback(TradeCallback callback) {
         tradeCallback = callback;
     }
+
+    void setBookEventCallback(BookEventCallback callback) {
+        bookEventCallback = callback;
+    }
 private:
     // ڲ˽д߼ٴظ
-    void match(Order* order, std::map<Price, Limit*, std::less<Price>>& partnerMap);
-    void match(Order* order, std::map<Price, Limit*, std::greater<Price>>& partnerMap);
+    void dispatchMatch(Order* order);
+
+    template<typename SidePolicy>
+    void dispatchMatch(Order* order, typename SidePolicy::PartnerMap& partnerMap);
+
+    // ͳһ㷨ڱȷ
+    template<typename SidePolicy, typename AllocationPolicy>
+    void match(Order* order, typename SidePolicy::PartnerMap& partnerMap);
+
+    // ժһλϵȫĹ
+    void purgeDeadOrders(Limit& limit);
+
+    template<typename LevelMap>
+    void compactSide(LevelMap& levels);
+
+    // Ͼۣ۸-ʱִһھ۸µĳɽ¼ݶ
+    template<typename LevelMap>
+    void executeAuctionSide(LevelMap& levels, uint64_t volume, std::vector<AuctionFill>& fills);
+
+    void applyAuctionFill(Limit& limit, Order* order, Quantity quantity);
+
+    // ɽ۸񼰸ż۸ϵĿյλ
+    template<typename LevelMap>
+    void releaseAuctionLevels(LevelMap& levels, Price price);
+
+    // ɽȫɽ黹ڴ
+    void releaseAuctionOrders();
 };
\ No newline at end of file
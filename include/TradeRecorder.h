@@ -0,0 +1,221 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Types.h"
+
+// --- ʽɽ / ¼־ ---
+// ļʽ
+//   ļͷ  : "LOBT" + uint32 汾
+//   ÿݿ: uint32  + uint32 ֽ[LogColumn::Count] + 
+// ÿ룺ID / ۸ڲֺ zigzag + varintֱ varint / Ϊԭʼֽڡ
+// ȡʱֻ谴ͷĳӦУȫ
+
+enum class LogEventType : uint8_t {
+    Trade,
+    Add,
+    Cancel
+};
+
+enum class LogColumn : uint8_t {
+    Type,       // LogEventType
+    Side,       // ɽΪ¼Ϊ
+    OrderId,    // ɽΪ Maker ID¼Ϊ ID
+    CounterId,  // ɽΪ Taker ID¼Ϊ 0
+    Price,
+    Quantity,
+    Count
+};
+
+// ߳д뻷λĶ¼
+struct LogRecord {
+    OrderId orderId;
+    OrderId counterId;
+    Price price;
+    Quantity quantity;
+    LogEventType type;
+    Side side;
+};
+
+constexpr uint32_t kTradeLogMagic = 0x54424F4C; // "LOBT"
+constexpr uint32_t kTradeLogVersion = 1;
+constexpr size_t kTradeLogColumns = static_cast<size_t>(LogColumn::Count);
+
+// varint / zigzag 
+inline void appendVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+//  end 10 ֽڣ64 λֵޣԽ˵𻵣 false
+inline bool readVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        uint8_t byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+inline uint64_t zigzagEncode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzagDecode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+// дˣ̰߳Ѽ¼Ž SPSC λ̸̨߳
+class TradeRecorder {
+private:
+    std::unique_ptr<LogRecord[]> ring;
+    size_t capacity;
+    size_t mask;
+
+    //  / ߵαֱռУα
+    alignas(64) std::atomic<uint64_t> head{ 0 };
+    uint64_t cachedTail = 0;
+    uint64_t droppedRecords = 0;    // ̨߳δʱļ¼ֻɴ߳޸
+    alignas(64) std::atomic<uint64_t> tail{ 0 };
+    alignas(64) std::atomic<bool> running{ false };
+
+    // --- ֻɺ̷̨߳ ---
+    std::FILE* file = nullptr;
+    uint32_t blockRows;
+    std::vector<LogRecord> pending;
+    std::vector<uint8_t> columns[kTradeLogColumns];
+    std::thread writer;
+
+public:
+    // capacity ȡ 2 
+    explicit TradeRecorder(size_t capacity = 1 << 16, uint32_t blockRows = 4096);
+    ~TradeRecorder();
+
+    TradeRecorder(const TradeRecorder&) = delete;
+    TradeRecorder& operator=(const TradeRecorder&) = delete;
+
+    // ļ̨̣߳ʧܷ false
+    bool open(const std::string& path);
+
+    // ȴſաдһ鲢رļ
+    void close();
+
+    // ̵߳ãдһ¼αꡣ
+    // δ openopen ʧܻ close ʱûк̨߳ѣ¼ false
+    bool recordTrade(const TradeReport& report) {
+        return push(LogRecord{ report.makerId, report.takerId, report.price, report.quantity,
+            LogEventType::Trade, report.takerSide });
+    }
+
+    bool recordEvent(const BookEvent& event) {
+        return push(LogRecord{ event.orderId, 0, event.price, event.quantity,
+            event.type == BookEventType::Add ? LogEventType::Add : LogEventType::Cancel, event.side });
+    }
+
+    // ֻӦڴ̶߳ȡ
+    uint64_t droppedCount() const { return droppedRecords; }
+
+private:
+    bool push(const LogRecord& record) {
+        // running ֻ open / close ʱдƽʱζȡл
+        if (!running.load(std::memory_order_relaxed)) {
+            ++droppedRecords;
+            return false;
+        }
+
+        uint64_t h = head.load(std::memory_order_relaxed);
+        // ʱȥαꣻȻó CPU ȴ̨̡߳
+        // ȴڼ¼̹߳رʱûƽ tail Զס
+        while (h - cachedTail >= capacity) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h - cachedTail < capacity) break;
+            if (!running.load(std::memory_order_relaxed)) {
+                ++droppedRecords;
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        ring[h & mask] = record;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    void run();
+    void flushBlock();
+};
+
+// ȡˣmmap ļɨ
+class TradeLogReader {
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    size_t validSize = 0;   // һݿĽβд;ɱʱĲп鱻
+    uint64_t rows = 0;
+
+public:
+    TradeLogReader() = default;
+    ~TradeLogReader();
+
+    TradeLogReader(const TradeLogReader&) = delete;
+    TradeLogReader& operator=(const TradeLogReader&) = delete;
+
+    // ӳļУļͷÿͷʧܷ falseļβĿᱻ
+    bool open(const std::string& path);
+    void close();
+
+    uint64_t rowCount() const { return rows; }
+
+    // ĳһУfn(int64_t value)
+    // ĳ varint Խβ򳬳ʱ鶪ɨڸÿֹͣضļĴһ£
+    template<typename Fn>
+    void scanColumn(LogColumn column, Fn&& fn) const {
+        if (!data) return;
+
+        const size_t index = static_cast<size_t>(column);
+        const uint8_t* block = data + 2 * sizeof(uint32_t);
+        const uint8_t* end = data + validSize; // open У˷Χڵпͷ
+        std::vector<int64_t> decoded;          // ɹŻص
+
+        while (block < end) {
+            uint32_t header[1 + kTradeLogColumns];
+            std::memcpy(header, block, sizeof(header));
+            const uint32_t blockRowCount = header[0];
+
+            // ǰУֱӶλ
+            const uint8_t* p = block + sizeof(header);
+            for (size_t c = 0; c < index; ++c) p += header[1 + c];
+
+            switch (column) {
+            case LogColumn::Type:
+            case LogColumn::Side:
+                for (uint32_t i = 0; i < blockRowCount; ++i) fn(static_cast<int64_t>(p[i]));
+                break;
+            default:
+                if (!decodeVarintColumn(column, p, p + header[1 + index], blockRowCount, decoded)) return;
+                for (int64_t value : decoded) fn(value);
+                break;
+            }
+
+            // һ
+            const uint8_t* next = block + sizeof(header);
+            for (size_t c = 0; c < kTradeLogColumns; ++c) next += header[1 + c];
+            block = next;
+        }
+    }
+
+    std::vector<int64_t> readColumn(LogColumn column) const;
+
+private:
+    // һе varint н뵽 outⲻ rowCount ֵԽ end ʱ false
+    static bool decodeVarintColumn(LogColumn column, const uint8_t* p, const uint8_t* end,
+        uint32_t rowCount, std::vector<int64_t>& out);
+};
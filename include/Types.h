@@ -27,4 +27,25 @@ struct TradeReport {
     Price price;       // ɽ۸
     Quantity quantity; // ɽ
     Side takerSide;    // 
+};
+
+// ¼ҵ / 
+enum class BookEventType : uint8_t {
+    Add,
+    Cancel
+};
+
+struct BookEvent {
+    BookEventType type;
+    OrderId orderId;
+    Side side;
+    Price price;
+    Quantity quantity;  // ʱΪܹҵɽʱΪʣ
+};
+
+// Ͼ۴Ͻ
+struct AuctionResult {
+    Price price = 0;       // ۸
+    uint64_t volume = 0;   // ɳɽ0 ʾδ棬޷ϣ൵ۼƿܳ Quantity Χ
+    int64_t surplus = 0;   // ü۸µʣΪʣ࣬Ϊʣ
 };
\ No newline at end of file
@@ -1,9 +1,12 @@
 #include "../include/Limit.h"
+#include <algorithm>
 
 void addOrderToLimit(Limit& limit, Order* order) {
     // 1. ¸ü۸λͳϢ
     limit.totalVolume += order->quantity; // ü۸ܱ
+    limit.hiddenVolume += order->hiddenQuantity; // ɽزֵͳ
     limit.orderCount++;                  // ü۸Ķ 1
+    order->limit = &limit;               // ¼ڵλӳٳʱֱʹ
 
     // 2. ˫
     if (limit.head == nullptr) {
@@ -33,4 +36,32 @@ void removeOrderFromLimit(Limit& limit, Order* order) {
     // ע⣺ﲻҪд limit.totalVolume -= ...
     // ΪɽµƳѾ match м
     // µƳ cancelOrder ֶ
+}
+
+void moveOrderToTail(Limit& limit, Order* order) {
+    // ѾڶβƶҲֻһ
+    if (limit.tail == order) return;
+
+    // 1. ԭժ£Ķ orderCount
+    if (order->prev) order->prev->next = order->next;
+    if (order->next) order->next->prev = order->prev;
+    if (limit.head == order) limit.head = order->next;
+
+    // 2. ¹ҵβʧȥʱȼ
+    order->prev = limit.tail;
+    order->next = nullptr;
+    limit.tail->next = order;
+    limit.tail = order;
+}
+
+void replenishOrder(Limit& limit, Order* order) {
+    // ɽչʾֳɽϣӴˢһƬO(1)ڴҲ ID
+    Quantity slice = std::min(order->displayQuantity, order->hiddenQuantity);
+    order->hiddenQuantity -= slice;
+    order->quantity = slice;
+
+    limit.hiddenVolume -= slice;
+    limit.totalVolume += slice;
+
+    moveOrderToTail(limit, order);
 }
\ No newline at end of file
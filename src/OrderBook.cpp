@@ -2,8 +2,11 @@
 #include "Limit.h"
 #include <atomic>
 #include <algorithm>
+#include <cstdlib>
+#include <iterator>
 
-OrderBook::OrderBook() : orderPool(100000), limitPool(10000) {
+OrderBook::OrderBook(MatchingAlgorithm algorithm)
+    : orderPool(100000), limitPool(10000), algorithm(algorithm) {
     // Ĭϻصֻӡһм򵥵־
     tradeCallback = [](const TradeReport& report) {
         printf("TRADE: Taker %llu matched Maker %llu | Qty: %u @ Price: %lld\n",
@@ -50,6 +53,13 @@ void OrderBook::addOrder(Order* order) {
 */
 
 OrderId OrderBook::addOrder(Side side, Price price, Quantity quantity) {
+    // ͨչʾıɽ
+    return addIcebergOrder(side, price, quantity, quantity);
+}
+
+OrderId OrderBook::addIcebergOrder(Side side, Price price, Quantity quantity, Quantity displayQuantity) {
+    if (displayQuantity == 0 || displayQuantity > quantity) displayQuantity = quantity;
+
     Order* order = orderPool.acquire();
     static std::atomic<OrderId> nextId{ 1 };
     order->id = nextId.fetch_add(1);
@@ -58,16 +68,28 @@ OrderId OrderBook::addOrder(Side side, Price price, Quantity quantity) {
     order->quantity = quantity;
     order->next = nullptr;
     order->prev = nullptr;
+    order->displayQuantity = 0;
+    order->hiddenQuantity = 0;
+    order->dead = false;
+    order->limit = nullptr;
 
-    if (order->side == Side::Buy) {
-        match(order, asks);
-    }
-    else {
-        match(order, bids);
-    }
+    // Ϊ Taker ʱɽȫϣϾڼֻҵ
+    if (!auctionMode) dispatchMatch(order);
 
     if (order->quantity > 0) {
+        // ʣಿֹҵʱŲֳչʾش
+        if (order->quantity > displayQuantity) {
+            order->displayQuantity = displayQuantity;
+            order->hiddenQuantity = order->quantity - displayQuantity;
+            order->quantity = displayQuantity;
+        }
+
         orderIndex[order->id] = order;
+        if (bookEventCallback) {
+            bookEventCallback(BookEvent{ BookEventType::Add, order->id, order->side, order->price,
+                order->quantity + order->hiddenQuantity });
+        }
+
         // ֿ̣Ͳƥ
         if (order->side == Side::Buy) {
             if (bids.find(order->price) == bids.end()) {
@@ -99,112 +121,156 @@ OrderId OrderBook::addOrder(Side side, Price price, Quantity quantity) {
     return order->id;
 }
 
-void OrderBook::match(Order* order, std::map<Price, Limit*, std::less<Price>>& partnerMap) {
-    while (order->quantity > 0 && !partnerMap.empty()) {
-        auto it = partnerMap.begin();
-        // 򵥼۸ >= ͼ۲ܳɽ
-        if (order->price < it->first) break;
+void OrderBook::dispatchMatch(Order* order) {
+    // ÿֻһΣѭڲ㷨֧
+    if (order->side == Side::Buy) {
+        dispatchMatch<BuySide>(order, asks);
+    }
+    else {
+        dispatchMatch<SellSide>(order, bids);
+    }
+
+    // ϳԿյĵλӳģʽ±ͬѹֵ
+    // ڴѭ֮ѹʹѭеĵʧЧ
+    if (pendingCompaction >= compactionThreshold) compact();
+}
+
+template<typename SidePolicy>
+void OrderBook::dispatchMatch(Order* order, typename SidePolicy::PartnerMap& partnerMap) {
+    switch (algorithm) {
+    case MatchingAlgorithm::ProRata:
+        match<SidePolicy, ProRataAllocation>(order, partnerMap);
+        break;
+    case MatchingAlgorithm::TopOrderProRata:
+        match<SidePolicy, TopOrderProRataAllocation>(order, partnerMap);
+        break;
+    default:
+        match<SidePolicy, FifoAllocation>(order, partnerMap);
+        break;
+    }
+}
+
+template<typename SidePolicy, typename AllocationPolicy>
+void OrderBook::match(Order* order, typename SidePolicy::PartnerMap& partnerMap) {
+    auto it = partnerMap.begin();
+    while (order->quantity > 0 && it != partnerMap.end()) {
+        if (!SidePolicy::crosses(order->price, it->first)) break;
 
         Limit* limit = it->second;
-        Order* curr = limit->head;
+        Price tradePrice = it->first;
 
-        while (curr && order->quantity > 0) {
-            Quantity matchQty = std::min(order->quantity, curr->quantity);
+        // Ͼʱ˳ժĹ
+        bool wasLive = limit->orderCount > 0;
+        if (limit->deadCount > 0) purgeDeadOrders(*limit);
 
+        auto fill = [&](Order* maker, Quantity matchQty) {
             // ɽرص
             if (tradeCallback) {
                 tradeCallback(TradeReport{
-                    curr->id,       // Maker (Ѿϵ)
-                    order->id,      // Taker (½)
-                    it->first,      // ɽ
+                    maker->id,              // Maker (ѾϵĶ)
+                    order->id,              // Taker (½Ķ)
+                    tradePrice,             // ɽ
                     matchQty,
-                    Side::Buy       // 
+                    SidePolicy::takerSide   // 
                     });
             }
 
             // 
             order->quantity -= matchQty;
-            curr->quantity -= matchQty;
+            maker->quantity -= matchQty;
             limit->totalVolume -= matchQty;
 
-            if (curr->quantity == 0) {
-                Order* next = curr->next;
+            if (maker->quantity == 0 && maker->hiddenQuantity > 0) {
+                // ɽӴˢ²ԭƵβس
+                replenishOrder(*limit, maker);
+            }
+            else if (maker->quantity == 0) {
                 // ӵλƳɾ
-                removeOrderFromLimit(*limit, curr);
-                orderIndex.erase(curr->id);
+                removeOrderFromLimit(*limit, maker);
+                orderIndex.erase(maker->id);
 
                 // --- ޸ģնڴ浽 ---
-                orderPool.release(curr);
+                orderPool.release(maker);
+            }
+        };
 
-                curr = next;
+        if (limit->orderCount > 0) {
+            AllocationPolicy::allocate(*limit, order->quantity, allocationScratch, fill);
+        }
+
+        // λˣƳλ Limit ڴ棻ӳģʽ±´ѹ
+        if (limit->orderCount == 0) {
+            if (lazyCancel) {
+                if (wasLive) ++pendingCompaction;
+                ++it;
             }
             else {
-                break; // ǰû꣬Ѻľ
+                it = partnerMap.erase(it);
+                limitPool.release(limit);
             }
         }
+    }
+}
 
-        // λˣƳλ Limit ڴ
-        if (limit->orderCount == 0) {
-            partnerMap.erase(it);
-            limitPool.release(limit);
+void OrderBook::purgeDeadOrders(Limit& limit) {
+    Order* curr = limit.head;
+    while (curr && limit.deadCount > 0) {
+        Order* next = curr->next;
+        if (curr->dead) {
+            // ڴĹʱѾ totalVolume / hiddenVolume п۳
+            removeOrderFromLimit(limit, curr);
+            orderIndex.erase(curr->id);
+            orderPool.release(curr);
+            limit.deadCount--;
+            deadOrderCount--;
         }
+        curr = next;
     }
 }
 
-void OrderBook::match(Order* order, std::map<Price, Limit*, std::greater<Price>>& partnerMap) {
-    while (order->quantity > 0 && !partnerMap.empty()) {
-        auto it = partnerMap.begin();
-        // ۸ <= ߼۲ܳɽ
-        if (order->price > it->first) break;
-
+template<typename LevelMap>
+void OrderBook::compactSide(LevelMap& levels) {
+    for (auto it = levels.begin(); it != levels.end();) {
         Limit* limit = it->second;
-        Order* curr = limit->head;
-
-        while (curr && order->quantity > 0) {
-            Quantity matchQty = std::min(order->quantity, curr->quantity);
-
-            if (tradeCallback) {
-                tradeCallback(TradeReport{
-                    curr->id,       // Maker (Ѿϵ)
-                    order->id,      // Taker (½)
-                    it->first,
-                    matchQty,
-                    Side::Sell      // 
-                    });
-            }
-
-            order->quantity -= matchQty;
-            curr->quantity -= matchQty;
-            limit->totalVolume -= matchQty;
-
-            if (curr->quantity == 0) {
-                Order* next = curr->next;
-                removeOrderFromLimit(*limit, curr);
-                orderIndex.erase(curr->id);
-
-                // --- ޸ģնڴ浽 ---
-                orderPool.release(curr);
-
-                curr = next;
-            }
-            else {
-                break;
-            }
-        }
+        if (limit->deadCount > 0) purgeDeadOrders(*limit);
 
         if (limit->orderCount == 0) {
-            partnerMap.erase(it);
             limitPool.release(limit);
+            it = levels.erase(it);
+        }
+        else {
+            ++it;
         }
     }
 }
 
+void OrderBook::compact() {
+    compactSide(bids);
+    compactSide(asks);
+    pendingCompaction = 0;
+}
+
+void OrderBook::setLazyCancel(bool enabled, uint32_t threshold) {
+    // رǰĹͱĿյλصĲʽ
+    if (!enabled) compact();
+    lazyCancel = enabled;
+    compactionThreshold = threshold;
+}
+
 size_t OrderBook::getOrderCount() const {
-    return orderIndex.size();
+    return orderIndex.size() - deadOrderCount;
 }
 
 bool OrderBook::hasLimit(Side side, Price price) const {
-    return (side == Side::Buy) ? bids.count(price) > 0 : asks.count(price) > 0;
+    // Ŀյλ / ֻʣĹĵλ
+    if (side == Side::Buy) {
+        auto it = bids.find(price);
+        return it != bids.end() && it->second->totalVolume > 0;
+    }
+    else {
+        auto it = asks.find(price);
+        return it != asks.end() && it->second->totalVolume > 0;
+    }
 }
 
 Quantity OrderBook::getVolumeAtPrice(Side side, Price price) const {
@@ -218,18 +284,54 @@ Quantity OrderBook::getVolumeAtPrice(Side side, Price price) const {
     }
 }
 
+size_t OrderBook::getLevelCount(Side side) const {
+    return (side == Side::Buy) ? bids.size() : asks.size();
+}
+
+Quantity OrderBook::getHiddenVolumeAtPrice(Side side, Price price) const {
+    if (side == Side::Buy) {
+        auto it = bids.find(price);
+        return (it != bids.end()) ? it->second->hiddenVolume : 0;
+    }
+    else {
+        auto it = asks.find(price);
+        return (it != asks.end()) ? it->second->hiddenVolume : 0;
+    }
+}
+
 void OrderBook::cancelOrder(OrderId orderId) {
     auto it = orderIndex.find(orderId);
     if (it == orderIndex.end()) return;
 
     Order* order = it->second;
     Price price = order->price;
+    if (order->dead) return;
+
+    if (bookEventCallback) {
+        bookEventCallback(BookEvent{ BookEventType::Cancel, order->id, order->side, order->price,
+            order->quantity + order->hiddenQuantity });
+    }
+
+    if (lazyCancel) {
+
+        // ֻĹۼɼժƳ
+        Limit* limit = order->limit;
+        order->dead = true;
+        limit->totalVolume -= order->quantity;
+        limit->hiddenVolume -= order->hiddenQuantity;
+        limit->deadCount++;
+        deadOrderCount++;
+
+        if (++pendingCompaction >= compactionThreshold) compact();
+        return;
+    }
 
     if (order->side == Side::Buy) {
         auto lit = bids.find(price);
         if (lit != bids.end()) {
             Limit* limit = lit->second;
             limit->totalVolume -= order->quantity;
+            limit->hiddenVolume -= order->hiddenQuantity;
             removeOrderFromLimit(*limit, order);
             if (limit->orderCount == 0) {
                 limitPool.release(limit);
@@ -242,6 +344,7 @@ void OrderBook::cancelOrder(OrderId orderId) {
         if (lit != asks.end()) {
             Limit* limit = lit->second;
             limit->totalVolume -= order->quantity;
+            limit->hiddenVolume -= order->hiddenQuantity;
             removeOrderFromLimit(*limit, order);
             if (limit->orderCount == 0) {
                 limitPool.release(limit);
@@ -261,6 +364,7 @@ MarketSnapshot OrderBook::getSnapshot(int depth) const {
     int b_count = 0;
     for (auto const& [price, limit] : bids) {
         if (b_count >= depth) break;
+        if (limit->totalVolume == 0) continue; // յλ봿Ĺλ
         snapshot.bids.push_back({ price, limit->totalVolume });
         b_count++;
     }
@@ -269,6 +373,7 @@ MarketSnapshot OrderBook::getSnapshot(int depth) const {
     int a_count = 0;
     for (auto const& [price, limit] : asks) {
         if (a_count >= depth) break;
+        if (limit->totalVolume == 0) continue;
         snapshot.asks.push_back({ price, limit->totalVolume });
         a_count++;
     }
@@ -279,6 +384,9 @@ MarketSnapshot OrderBook::getSnapshot(int depth) const {
 Quantity OrderBook::addMarketOrder(Side side, Quantity quantity) {
     if (quantity <= 0) return 0;
 
+    // Ͼڼм۵޷ҵֱӾܾ
+    if (auctionMode) return 0;
+
     Quantity originalQuantity = quantity;
 
     // һ۸Ϊ󡱻Сʱ
@@ -291,13 +399,301 @@ Quantity OrderBook::addMarketOrder(Side side, Quantity quantity) {
     // ע⣺ID Ϊ 0Ϊм۵ɽҲҵ
     Order tempOrder{ 0, side, marketPrice, quantity };
 
-    if (side == Side::Buy) {
-        match(&tempOrder, asks);
+    dispatchMatch(&tempOrder);
+
+    // ʵʳɽ
+    return originalQuantity - tempOrder.quantity;
+}
+
+void OrderBook::startAuction() {
+    auctionMode = true;
+}
+
+AuctionResult OrderBook::getIndicativeUncross(Price referencePrice) const {
+    AuctionResult result;
+    // ӳٳģʽ±Ŀյλ
+    auto bestBidIt = std::find_if(bids.begin(), bids.end(), [](auto const& level) { return level.second->totalVolume > 0; });
+    auto bestAskIt = std::find_if(asks.begin(), asks.end(), [](auto const& level) { return level.second->totalVolume > 0; });
+    if (bestBidIt == bids.end() || bestAskIt == asks.end()) return result;
+
+    Price bestBid = bestBidIt->first;
+    Price bestAsk = bestAskIt->first;
+    if (bestBid < bestAsk) return result; // ûн
+
+    // 䣺 >= bestAsk 򵵣 <= bestBid 
+    auto bidEnd = bids.upper_bound(bestAsk);
+    auto askEnd = asks.upper_bound(bestBid);
+
+    // ͺѡ bestAsk ϵۼ = ȫɽҲ뾺ۣ
+    uint64_t demand = 0;
+    for (auto it = bids.begin(); it != bidEnd; ++it) {
+        demand += static_cast<uint64_t>(it->second->totalVolume) + it->second->hiddenVolume;
+    }
+    uint64_t supply = 0;
+
+    // һɨ裺ѡ۸ӵ͵ߣ򵵵鲢
+    auto askIt = asks.begin();
+    auto bidIt = std::make_reverse_iterator(bidEnd);
+    auto bidRend = bids.rend();
+
+    uint64_t bestVolume = 0;
+    uint64_t bestImbalance = 0;
+    std::vector<std::pair<Price, int64_t>> tied; // кѡ۸ʣ
+
+    // ӳٳģʽ±ĿյλǺѡ۸񣬷ۻܲλӰ
+    auto isEmpty = [](Limit const* limit) { return limit->totalVolume == 0 && limit->hiddenVolume == 0; };
+
+    while (true) {
+        while (askIt != askEnd && isEmpty(askIt->second)) ++askIt;
+        while (bidIt != bidRend && isEmpty(bidIt->second)) ++bidIt;
+        if (askIt == askEnd && bidIt == bidRend) break;
+
+        Price p;
+        if (askIt == askEnd) p = bidIt->first;
+        else if (bidIt == bidRend) p = askIt->first;
+        else p = std::min(askIt->first, bidIt->first);
+
+        //  <= p 빩
+        if (askIt != askEnd && askIt->first == p) {
+            supply += static_cast<uint64_t>(askIt->second->totalVolume) + askIt->second->hiddenVolume;
+            ++askIt;
+        }
+
+        uint64_t volume = std::min(demand, supply);
+        int64_t surplus = static_cast<int64_t>(demand) - static_cast<int64_t>(supply);
+        uint64_t imbalance = static_cast<uint64_t>(surplus < 0 ? -surplus : surplus);
+
+        //  1ɽ󣻹 2ʣС
+        if (volume > bestVolume || (volume == bestVolume && imbalance < bestImbalance)) {
+            bestVolume = volume;
+            bestImbalance = imbalance;
+            tied.clear();
+        }
+        if (volume == bestVolume && imbalance == bestImbalance && volume > 0) {
+            tied.push_back({ p, surplus });
+        }
+
+        //  == p ڸߵĺѡϲټ
+        if (bidIt != bidRend && bidIt->first == p) {
+            demand -= static_cast<uint64_t>(bidIt->second->totalVolume) + bidIt->second->hiddenVolume;
+            ++bidIt;
+        }
+    }
+
+    if (tied.empty()) return result;
+
+    //  3гѹȫΪʣȡ߼ۣȫΪʣȡͼ
+    bool allBuy = true;
+    bool allSell = true;
+    for (auto const& [price, surplus] : tied) {
+        allBuy = allBuy && surplus > 0;
+        allSell = allSell && surplus < 0;
+    }
+
+    size_t chosen = 0;
+    if (allBuy) {
+        chosen = tied.size() - 1;
+    }
+    else if (!allSell) {
+        //  4ӽοۣδοʱȡе
+        Price reference = (referencePrice != 0) ? referencePrice
+            : tied.front().first + (tied.back().first - tied.front().first) / 2;
+        for (size_t i = 1; i < tied.size(); ++i) {
+            Price d = std::abs(tied[i].first - reference);
+            if (d < std::abs(tied[chosen].first - reference)) chosen = i;
+        }
+    }
+
+    result.price = tied[chosen].first;
+    result.volume = bestVolume;
+    result.surplus = tied[chosen].second;
+    return result;
+}
+
+template<typename LevelMap>
+void OrderBook::executeAuctionSide(LevelMap& levels, uint64_t volume, std::vector<AuctionFill>& fills) {
+    // 1. ɵλҳԵĵλÿȫɽݶ fills еλÿԤ
+    struct Cursor {
+        Limit* limit;
+        Order* curr;
+        Order* kept;    // ɽֻʣĹ߱߰´
+        size_t out;
+    };
+    std::vector<Cursor> fullLevels;
+    size_t fullFills = 0;
+
+    auto it = levels.begin();
+    for (; it != levels.end() && volume > 0; ++it) {
+        Limit* limit = it->second;
+        uint64_t levelVolume = static_cast<uint64_t>(limit->totalVolume) + limit->hiddenVolume;
+        if (levelVolume > volume) break; // ߼ʵλֻɽһ
+        volume -= levelVolume;
+        fullLevels.push_back({ limit, limit->head, nullptr, fullFills });
+        fullFills += limit->orderCount - limit->deadCount;
+    }
+    fills.resize(fullFills);
+
+    // 2. ɽĵλƽأÿһ
+    //    λĻδпͬʱ;һȴ
+    //    ɽĶժλֻĹ
+    constexpr size_t kWays = 8;
+    Cursor active[kWays];
+    size_t activeCount = 0;
+    size_t pending = 0;
+    while (activeCount < kWays && pending < fullLevels.size()) active[activeCount++] = fullLevels[pending++];
+
+    while (activeCount > 0) {
+        for (size_t k = 0; k < activeCount;) {
+            Cursor& cursor = active[k];
+            Limit* limit = cursor.limit;
+            if (!cursor.curr) {
+                if (cursor.kept) cursor.kept->next = nullptr;
+                else limit->head = nullptr;
+                limit->tail = cursor.kept;
+                limit->orderCount = limit->deadCount;
+                limit->totalVolume = 0;
+                limit->hiddenVolume = 0;
+
+                // ꣬һλû˾һα겹λ
+                cursor = pending < fullLevels.size() ? fullLevels[pending++] : active[--activeCount];
+                continue;
+            }
+
+            Order* order = cursor.curr;
+            cursor.curr = order->next;
+            if (order->dead) {
+                order->prev = cursor.kept;
+                if (cursor.kept) cursor.kept->next = order;
+                else limit->head = order;
+                cursor.kept = order;
+            }
+            else {
+                fills[cursor.out++] = { order->id, order->quantity + order->hiddenQuantity };
+                order->quantity = 0;
+                order->hiddenQuantity = 0;
+                auctionFilledOrders.push_back(order);
+            }
+            ++k;
+        }
+    }
+
+    // 3. ߼ʵλʱȳɽʣֻһʿֳܲɽɽᱻƵβ֮ѭ
+    if (it == levels.end() || volume == 0) return;
+    Limit* limit = it->second;
+    Order* curr = limit->head;
+    while (curr && volume > 0) {
+        Order* next = curr->next;
+        if (!curr->dead) {
+            Quantity qty = static_cast<Quantity>(std::min<uint64_t>(volume,
+                static_cast<uint64_t>(curr->quantity) + curr->hiddenQuantity));
+            fills.push_back({ curr->id, qty });
+            volume -= qty;
+            applyAuctionFill(*limit, curr, qty);
+        }
+        curr = next;
+    }
+}
+
+void OrderBook::applyAuctionFill(Limit& limit, Order* order, Quantity quantity) {
+    // ȿչʾ㲿ֱӴӱɽп
+    Quantity fromVisible = std::min(quantity, order->quantity);
+    Quantity fromHidden = quantity - fromVisible;
+    order->quantity -= fromVisible;
+    order->hiddenQuantity -= fromHidden;
+    limit.totalVolume -= fromVisible;
+    limit.hiddenVolume -= fromHidden;
+
+    if (order->quantity == 0 && order->hiddenQuantity > 0) {
+        replenishOrder(limit, order);
+    }
+    else if (order->quantity == 0) {
+        // ֻժڴصɽ
+        removeOrderFromLimit(limit, order);
+        auctionFilledOrders.push_back(order);
+    }
+}
+
+void OrderBook::releaseAuctionOrders() {
+    if (auctionFilledOrders.size() * 4 >= orderIndex.size()) {
+        // Ե൱һֶɾÿζһͰ
+        // ˳ɨһ˳ְѳɽĶ黹ڴأϵĻ 0
+        for (auto it = orderIndex.begin(); it != orderIndex.end();) {
+            Order* order = it->second;
+            if (order->quantity == 0 && !order->dead) {
+                orderPool.release(order);
+                it = orderIndex.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
     }
     else {
-        match(&tempOrder, bids);
+        for (Order* order : auctionFilledOrders) {
+            orderIndex.erase(order->id);
+            orderPool.release(order);
+        }
     }
+    auctionFilledOrders.clear();
+}
 
-    // ʵʳɽ
-    return originalQuantity - tempOrder.quantity;
+template<typename LevelMap>
+void OrderBook::releaseAuctionLevels(LevelMap& levels, Price price) {
+    auto it = levels.begin();
+    while (it != levels.end() && !levels.key_comp()(price, it->first)) {
+        Limit* limit = it->second;
+        if (limit->deadCount > 0) purgeDeadOrders(*limit);
+
+        // ϾһԵ¼Կյĵλֱͷţ
+        if (limit->orderCount == 0) {
+            it = levels.erase(it);
+            limitPool.release(limit);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+AuctionResult OrderBook::uncross(Price referencePrice) {
+    AuctionResult result = getIndicativeUncross(referencePrice);
+    auctionMode = false;
+    if (result.volume == 0) return result;
+
+    // 1. ఴ۸-ʱһִгɽݶ
+    executeAuctionSide(bids, result.volume, auctionBidFills);
+    executeAuctionSide(asks, result.volume, auctionAskFills);
+
+    // 2. ķݶɳɽرȫԾ۸ɽȵĶΪ Maker
+    if (tradeCallback) {
+        size_t i = 0, j = 0;
+        Quantity bidLeft = auctionBidFills[0].quantity;
+        Quantity askLeft = auctionAskFills[0].quantity;
+        while (i < auctionBidFills.size() && j < auctionAskFills.size()) {
+            OrderId buyId = auctionBidFills[i].id;
+            OrderId sellId = auctionAskFills[j].id;
+            Quantity qty = std::min(bidLeft, askLeft);
+
+            bool buyIsMaker = buyId < sellId;
+            tradeCallback(TradeReport{
+                buyIsMaker ? buyId : sellId,
+                buyIsMaker ? sellId : buyId,
+                result.price,
+                qty,
+                buyIsMaker ? Side::Sell : Side::Buy
+                });
+
+            bidLeft -= qty;
+            askLeft -= qty;
+            if (bidLeft == 0 && ++i < auctionBidFills.size()) bidLeft = auctionBidFills[i].quantity;
+            if (askLeft == 0 && ++j < auctionAskFills.size()) askLeft = auctionAskFills[j].quantity;
+        }
+    }
+
+    // 3. Կյĵλ
+    releaseAuctionLevels(bids, result.price);
+    releaseAuctionLevels(asks, result.price);
+    releaseAuctionOrders();
+
+    return result;
 }
\ No newline at end of file
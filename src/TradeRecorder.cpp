@@ -0,0 +1,240 @@
+#include "TradeRecorder.h"
+#include <chrono>
+#include <cstring>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+TradeRecorder::TradeRecorder(size_t requestedCapacity, uint32_t blockRows)
+    : capacity(1), blockRows(blockRows) {
+    while (capacity < requestedCapacity) capacity <<= 1;
+    mask = capacity - 1;
+    ring = std::make_unique<LogRecord[]>(capacity);
+    pending.reserve(blockRows);
+}
+
+TradeRecorder::~TradeRecorder() {
+    close();
+}
+
+bool TradeRecorder::open(const std::string& path) {
+    if (running.load()) return false;
+
+    file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    uint32_t header[2] = { kTradeLogMagic, kTradeLogVersion };
+    std::fwrite(header, sizeof(header), 1, file);
+
+    head.store(0);
+    tail.store(0);
+    cachedTail = 0;
+    running.store(true, std::memory_order_release);
+    writer = std::thread(&TradeRecorder::run, this);
+    return true;
+}
+
+void TradeRecorder::close() {
+    if (!writer.joinable()) return;
+
+    // ߵһ push  storę߳̿ false 󻹻ſһ
+    running.store(false, std::memory_order_release);
+    writer.join();
+
+    std::fclose(file);
+    file = nullptr;
+}
+
+void TradeRecorder::run() {
+    while (true) {
+        bool stopping = !running.load(std::memory_order_acquire);
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t h = head.load(std::memory_order_acquire);
+
+        if (t == h) {
+            if (stopping) break;
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            continue;
+        }
+
+        for (; t != h; ++t) {
+            pending.push_back(ring[t & mask]);
+            if (pending.size() == blockRows) flushBlock();
+        }
+        tail.store(h, std::memory_order_release);
+    }
+
+    flushBlock();
+    std::fflush(file);
+}
+
+void TradeRecorder::flushBlock() {
+    if (pending.empty()) return;
+
+    for (auto& column : columns) column.clear();
+
+    auto& type = columns[static_cast<size_t>(LogColumn::Type)];
+    auto& side = columns[static_cast<size_t>(LogColumn::Side)];
+    auto& orderId = columns[static_cast<size_t>(LogColumn::OrderId)];
+    auto& counterId = columns[static_cast<size_t>(LogColumn::CounterId)];
+    auto& price = columns[static_cast<size_t>(LogColumn::Price)];
+    auto& quantity = columns[static_cast<size_t>(LogColumn::Quantity)];
+
+    // ֻ׼ÿ¿ʼ֤Զ
+    int64_t lastOrderId = 0;
+    int64_t lastCounterId = 0;
+    int64_t lastPrice = 0;
+
+    for (auto const& record : pending) {
+        type.push_back(static_cast<uint8_t>(record.type));
+        side.push_back(static_cast<uint8_t>(record.side));
+
+        int64_t id = static_cast<int64_t>(record.orderId);
+        appendVarint(orderId, zigzagEncode(id - lastOrderId));
+        lastOrderId = id;
+
+        int64_t counter = static_cast<int64_t>(record.counterId);
+        appendVarint(counterId, zigzagEncode(counter - lastCounterId));
+        lastCounterId = counter;
+
+        appendVarint(price, zigzagEncode(record.price - lastPrice));
+        lastPrice = record.price;
+
+        appendVarint(quantity, record.quantity);
+    }
+
+    uint32_t header[1 + kTradeLogColumns];
+    header[0] = static_cast<uint32_t>(pending.size());
+    for (size_t c = 0; c < kTradeLogColumns; ++c) header[1 + c] = static_cast<uint32_t>(columns[c].size());
+
+    std::fwrite(header, sizeof(header), 1, file);
+    for (auto const& column : columns) std::fwrite(column.data(), 1, column.size(), file);
+
+    pending.clear();
+}
+
+TradeLogReader::~TradeLogReader() {
+    close();
+}
+
+bool TradeLogReader::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(fileHandle, &fileSize);
+    size = static_cast<size_t>(fileSize.QuadPart);
+
+    HANDLE mapping = size ? CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    if (mapping) {
+        data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        // ͼᱣӳȹص
+        CloseHandle(mapping);
+    }
+    CloseHandle(fileHandle);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0) size = static_cast<size_t>(st.st_size);
+
+    if (size) {
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            data = static_cast<const uint8_t*>(mapped);
+            madvise(mapped, size, MADV_SEQUENTIAL);
+        }
+    }
+    ::close(fd);
+#endif
+
+    // Уļͷ
+    uint32_t header[2] = { 0, 0 };
+    if (data && size >= sizeof(header)) std::memcpy(header, data, sizeof(header));
+    if (header[0] != kTradeLogMagic || header[1] != kTradeLogVersion) {
+        close();
+        return false;
+    }
+
+    // ֻͷͳͬʱУͷ͸гȶļ
+    size_t offset = sizeof(header);
+    validSize = offset;
+    while (offset < size) {
+        uint32_t blockHeader[1 + kTradeLogColumns];
+        if (size - offset < sizeof(blockHeader)) break; // ͷض
+
+        std::memcpy(blockHeader, data + offset, sizeof(blockHeader));
+        const uint32_t blockRowCount = blockHeader[0];
+
+        uint64_t payload = 0;
+        bool valid = blockRowCount > 0;
+        for (size_t c = 0; c < kTradeLogColumns; ++c) {
+            payload += blockHeader[1 + c];
+            // ÿ 1 ֽڣvarint ÿ 1 ֽ
+            bool fixedWidth = c == static_cast<size_t>(LogColumn::Type) || c == static_cast<size_t>(LogColumn::Side);
+            valid = valid && (fixedWidth ? blockHeader[1 + c] == blockRowCount : blockHeader[1 + c] >= blockRowCount);
+        }
+        if (!valid || payload > size - offset - sizeof(blockHeader)) break; // ݱضϻͷ
+
+        offset += sizeof(blockHeader) + static_cast<size_t>(payload);
+        validSize = offset;
+        rows += blockRowCount;
+    }
+    return true;
+}
+
+void TradeLogReader::close() {
+    if (data) {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<uint8_t*>(data), size);
+#endif
+    }
+    data = nullptr;
+    size = 0;
+    validSize = 0;
+    rows = 0;
+}
+
+std::vector<int64_t> TradeLogReader::readColumn(LogColumn column) const {
+    std::vector<int64_t> values;
+    values.reserve(rows);
+    scanColumn(column, [&](int64_t value) { values.push_back(value); });
+    return values;
+}
+
+bool TradeLogReader::decodeVarintColumn(LogColumn column, const uint8_t* p, const uint8_t* end,
+    uint32_t rowCount, std::vector<int64_t>& out) {
+    out.resize(rowCount);
+    uint64_t raw = 0;
+
+    if (column == LogColumn::Quantity) {
+        for (uint32_t i = 0; i < rowCount; ++i) {
+            if (!readVarint(p, end, raw)) return false;
+            out[i] = static_cast<int64_t>(raw);
+        }
+        return true;
+    }
+
+    // ID / ۸񣺿ڲ
+    int64_t value = 0;
+    for (uint32_t i = 0; i < rowCount; ++i) {
+        if (!readVarint(p, end, raw)) return false;
+        value += zigzagDecode(raw);
+        out[i] = value;
+    }
+    return true;
+}
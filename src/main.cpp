@@ -5,6 +5,10 @@
 #include <algorithm>
 #include <numeric>
 #include <iomanip>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <memory>
 
 void RunBenchmark() {
     OrderBook book;
@@ -72,6 +76,140 @@ void RunBenchmark() {
     std::cout << "====================================================" << std::endl;
 }
 
+// ڶԱȵľɰڴأ̵߳ / նͬһȫ CAS
+template<typename T>
+class GlobalFreeListPool {
+private:
+    struct Node {
+        T data;
+        Node* next;
+    };
+
+    std::atomic<Node*> globalFreeList{ nullptr };
+    std::vector<std::unique_ptr<Node[]>> chunks;
+    std::mutex chunkMutex;
+    size_t chunkSize;
+
+public:
+    GlobalFreeListPool(size_t initialSize = 10000) : chunkSize(initialSize) {
+        expand();
+    }
+
+    T* acquire() {
+        Node* oldHead = globalFreeList.load(std::memory_order_acquire);
+        while (oldHead && !globalFreeList.compare_exchange_weak(oldHead, oldHead->next,
+            std::memory_order_acquire,
+            std::memory_order_acquire));
+
+        if (!oldHead) {
+            expand();
+            return acquire();
+        }
+        return new (&oldHead->data) T();
+    }
+
+    void release(T* obj) {
+        obj->~T();
+        Node* node = reinterpret_cast<Node*>(obj);
+        node->next = globalFreeList.load(std::memory_order_relaxed);
+        while (!globalFreeList.compare_exchange_weak(node->next, node,
+            std::memory_order_release,
+            std::memory_order_relaxed));
+    }
+
+private:
+    void expand() {
+        std::lock_guard<std::mutex> lock(chunkMutex);
+
+        auto newChunk = std::make_unique<Node[]>(chunkSize);
+        for (size_t i = 0; i < chunkSize - 1; ++i) {
+            newChunk[i].next = &newChunk[i + 1];
+        }
+
+        Node* oldHead = globalFreeList.load(std::memory_order_relaxed);
+        do {
+            newChunk[chunkSize - 1].next = oldHead;
+        } while (!globalFreeList.compare_exchange_weak(oldHead, &newChunk[0],
+            std::memory_order_release,
+            std::memory_order_relaxed));
+
+        chunks.push_back(std::move(newChunk));
+    }
+};
+
+// ڴؿ̻߳ղԣ߳붩һ͵ػգһ뽻̻߳
+template<typename Pool>
+void RunPoolWorkload(const char* name) {
+    const int iterations = 2000000;
+    const size_t ringSize = 1 << 14;
+
+    Pool pool(100000);
+
+    // ߳ -> ̵߳ĵߵ߽Ӷ
+    std::vector<Order*> ring(ringSize);
+    std::atomic<size_t> head{ 0 };
+    std::atomic<size_t> tail{ 0 };
+    std::atomic<bool> done{ false };
+
+    // ֻ߳ͳƻ release ϵʱ
+    long long publisherNs = 0;
+    size_t publisherReleases = 0;
+
+    std::thread publisher([&] {
+        size_t t = 0;
+        while (true) {
+            bool finished = done.load(std::memory_order_acquire);
+            size_t h = head.load(std::memory_order_acquire);
+            if (t == h) {
+                if (finished) break;
+                std::this_thread::yield();
+                continue;
+            }
+
+            publisherReleases += h - t;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (; t != h; ++t) pool.release(ring[t & (ringSize - 1)]);
+            auto end = std::chrono::high_resolution_clock::now();
+
+            publisherNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            tail.store(t, std::memory_order_release);
+        }
+        });
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < iterations; ++i) {
+        Order* order = pool.acquire();
+        if (i % 2 == 0) {
+            pool.release(order); // ̱߳ػ
+            continue;
+        }
+
+        size_t h = head.load(std::memory_order_relaxed);
+        while (h - tail.load(std::memory_order_acquire) >= ringSize) std::this_thread::yield();
+        ring[h & (ringSize - 1)] = order;
+        head.store(h + 1, std::memory_order_release);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    done.store(true, std::memory_order_release);
+    publisher.join();
+
+    std::chrono::duration<double> diff = end - start;
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+        << "owner " << std::setw(7) << (diff.count() * 1e9 / iterations) << " ns/pair   "
+        << "publisher " << std::setw(7) << (publisherReleases ? static_cast<double>(publisherNs) / publisherReleases : 0.0)
+        << " ns/release" << std::endl;
+}
+
+void RunPoolBenchmark() {
+    std::cout << "\n================ POOL REPORT ================" << std::endl;
+    std::cout << "Owner: 2M acquire/release pairs, half released by a publisher thread" << std::endl;
+    RunPoolWorkload<GlobalFreeListPool<Order>>("Global CAS (old)");
+    RunPoolWorkload<ThreadSafeObjectPool<Order>>("Owner + remote (new)");
+    std::cout << "=============================================" << std::endl;
+}
+
 int main() {
     // ȷ Release ģʽ
 #ifdef _DEBUG
@@ -79,6 +217,7 @@ int main() {
 #endif
 
     RunBenchmark();
+    RunPoolBenchmark();
 
     std::cout << "\nPress Enter to exit..." << std::endl;
     std::cin.get();
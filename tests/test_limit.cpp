@@ -39,4 +39,30 @@ TEST(LimitTest, RemoveMiddleOrder) {
     EXPECT_EQ(limit.tail, o3);
 
     delete o1; delete o2; delete o3;
-}
\ No newline at end of file
+}
+
+// ԣɽˢºԭƵβ
+TEST(LimitTest, ReplenishMovesToTail) {
+    Limit limit(100);
+    Order* o1 = new Order{ 1, Side::Sell, 100, 0 };
+    Order* o2 = new Order{ 2, Side::Sell, 100, 10 };
+    o1->displayQuantity = 5;
+    o1->hiddenQuantity = 12;
+
+    addOrderToLimit(limit, o1);
+    addOrderToLimit(limit, o2);
+    EXPECT_EQ(limit.hiddenVolume, 12);
+
+    replenishOrder(limit, o1);
+
+    EXPECT_EQ(limit.orderCount, 2);
+    EXPECT_EQ(limit.totalVolume, 15);
+    EXPECT_EQ(limit.hiddenVolume, 7);
+    EXPECT_EQ(o1->quantity, 5);
+    EXPECT_EQ(limit.head, o2);
+    EXPECT_EQ(limit.tail, o1);
+    EXPECT_EQ(o2->next, o1);
+    EXPECT_EQ(o1->prev, o2);
+
+    delete o1; delete o2;
+}
@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "gtest/gtest.h"
+#include "ObjectPool.h"
+#include "Order.h"
+#include <thread>
+#include <set>
+
+// ԣ̻߳պͬһڴ
+TEST(ObjectPoolTest, OwnerReuse) {
+    ThreadSafeObjectPool<Order> pool(4);
+
+    Order* o1 = pool.acquire();
+    pool.release(o1);
+    Order* o2 = pool.acquire();
+
+    EXPECT_EQ(o1, o2);
+    pool.release(o2);
+}
+
+// ԣ̻߳յĶڱľʱȡأ
+TEST(ObjectPoolTest, RemoteReleaseReclaimed) {
+    const int chunk = 64;
+    ThreadSafeObjectPool<Order> pool(chunk);
+
+    std::vector<Order*> orders;
+    for (int i = 0; i < chunk; ++i) orders.push_back(pool.acquire());
+
+    std::thread publisher([&] {
+        for (Order* order : orders) pool.release(order);
+        });
+    publisher.join();
+
+    // ѿգʱӦȫԶ̻յĽڵ
+    std::set<Order*> original(orders.begin(), orders.end());
+    for (int i = 0; i < chunk; ++i) {
+        Order* order = pool.acquire();
+        EXPECT_TRUE(original.count(order) > 0);
+    }
+}
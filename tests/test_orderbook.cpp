@@ -73,4 +73,314 @@ TEST(OrderBookTest, TradeCallbackTest) {
     EXPECT_EQ(tradeCount, 1);
     EXPECT_EQ(lastTrade.quantity, 4);
     EXPECT_EQ(lastTrade.price, 100);
-}
\ No newline at end of file
+}
+
+// ԣɽֻչʾɽӴˢ
+TEST(OrderBookTest, IcebergReplenishTest) {
+    OrderBook book;
+    book.setTradeCallback(nullptr);
+
+    OrderId iceberg = book.addIcebergOrder(Side::Sell, 100, 25, 10);
+
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 100), 10);
+    EXPECT_EQ(book.getHiddenVolumeAtPrice(Side::Sell, 100), 15);
+
+    auto snapshot = book.getSnapshot(5);
+    ASSERT_EQ(snapshot.asks.size(), 1);
+    EXPECT_EQ(snapshot.asks[0].volume, 10); // ղ¶
+
+    // ԵһƬˢ³ڶƬ
+    book.addOrder(Side::Buy, 100, 10);
+    EXPECT_EQ(book.getOrderCount(), 1);
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 100), 10);
+    EXPECT_EQ(book.getHiddenVolumeAtPrice(Side::Sell, 100), 5);
+
+    // ͬʱɼ
+    book.cancelOrder(iceberg);
+    EXPECT_EQ(book.getOrderCount(), 0);
+    EXPECT_FALSE(book.hasLimit(Side::Sell, 100));
+}
+
+// ԣɽˢºŵͬλβʧȥʱȼ
+TEST(OrderBookTest, IcebergLosesPriorityTest) {
+    OrderBook book;
+    std::vector<OrderId> makers;
+
+    book.setTradeCallback([&](const TradeReport& report) {
+        makers.push_back(report.makerId);
+        });
+
+    OrderId iceberg = book.addIcebergOrder(Side::Sell, 100, 20, 5);
+    OrderId plain = book.addOrder(Side::Sell, 100, 5);
+
+    // һʴ󵥳ԴɽһƬ -> ͨ -> ɽˢºĸƬ
+    Quantity filled = book.addMarketOrder(Side::Buy, 25);
+
+    EXPECT_EQ(filled, 25);
+    ASSERT_EQ(makers.size(), 5);
+    EXPECT_EQ(makers[0], iceberg);
+    EXPECT_EQ(makers[1], plain);
+    EXPECT_EQ(makers[2], iceberg);
+    EXPECT_EQ(book.getOrderCount(), 0);
+}
+
+
+// ԣ䣬ͷʱȲ
+TEST(OrderBookTest, ProRataAllocationTest) {
+    OrderBook book(MatchingAlgorithm::ProRata);
+    std::map<OrderId, Quantity> fills;
+
+    book.setTradeCallback([&](const TradeReport& report) {
+        fills[report.makerId] += report.quantity;
+        });
+
+    OrderId a = book.addOrder(Side::Sell, 100, 10);
+    OrderId b = book.addOrder(Side::Sell, 100, 30);
+    OrderId c = book.addOrder(Side::Sell, 100, 60);
+
+    // 11 ֣floor ݶΪ 1 / 3 / 6 = 10ʣ 1 ָ a
+    book.addOrder(Side::Buy, 100, 11);
+
+    EXPECT_EQ(fills[a], 2);
+    EXPECT_EQ(fills[b], 3);
+    EXPECT_EQ(fills[c], 6);
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 100), 89);
+    EXPECT_EQ(book.getOrderCount(), 3);
+}
+
+// ԣ׶ȳɽఴ
+TEST(OrderBookTest, TopOrderProRataTest) {
+    OrderBook book(MatchingAlgorithm::TopOrderProRata);
+    std::map<OrderId, Quantity> fills;
+
+    book.setTradeCallback([&](const TradeReport& report) {
+        fills[report.makerId] += report.quantity;
+        });
+
+    OrderId top = book.addOrder(Side::Buy, 100, 5);
+    OrderId b = book.addOrder(Side::Buy, 100, 10);
+    OrderId c = book.addOrder(Side::Buy, 100, 30);
+
+    book.addOrder(Side::Sell, 100, 25);
+
+    EXPECT_EQ(fills[top], 5);
+    EXPECT_EQ(fills[b], 5);
+    EXPECT_EQ(fills[c], 15);
+    EXPECT_EQ(book.getOrderCount(), 2);
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Buy, 100), 20);
+}
+
+
+// ԣӳٳֻĹϾʱժյλѹ
+TEST(OrderBookTest, LazyCancelTest) {
+    OrderBook book;
+    std::vector<OrderId> makers;
+
+    book.setTradeCallback([&](const TradeReport& report) {
+        makers.push_back(report.makerId);
+        });
+    book.setLazyCancel(true);
+
+    OrderId a = book.addOrder(Side::Sell, 100, 10);
+    OrderId b = book.addOrder(Side::Sell, 100, 10);
+    OrderId c = book.addOrder(Side::Sell, 101, 10);
+
+    book.cancelOrder(a);
+    book.cancelOrder(a); // ظ޸
+    book.cancelOrder(c);
+
+    EXPECT_EQ(book.getOrderCount(), 1);
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 100), 10);
+    EXPECT_FALSE(book.hasLimit(Side::Sell, 101));
+
+    auto snapshot = book.getSnapshot(5);
+    ASSERT_EQ(snapshot.asks.size(), 1);
+    EXPECT_EQ(snapshot.asks[0].price, 100);
+
+    // Ĺ aֱ b ɽ
+    book.addOrder(Side::Buy, 101, 10);
+    ASSERT_EQ(makers.size(), 1);
+    EXPECT_EQ(makers[0], b);
+    EXPECT_EQ(book.getOrderCount(), 0);
+
+    // յλ¶ֱӸ
+    book.addOrder(Side::Sell, 100, 7);
+    EXPECT_TRUE(book.hasLimit(Side::Sell, 100));
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 100), 7);
+
+    book.compact();
+    EXPECT_TRUE(book.hasLimit(Side::Sell, 100));
+    EXPECT_EQ(book.getOrderCount(), 1);
+}
+
+
+// ԣϾڼֻҵuncross Գɽļ۸һԳɽ
+TEST(OrderBookTest, AuctionUncrossTest) {
+    OrderBook book;
+    Quantity traded = 0;
+    Price tradePrice = 0;
+
+    book.setTradeCallback([&](const TradeReport& report) {
+        traded += report.quantity;
+        tradePrice = report.price;
+        });
+
+    book.startAuction();
+    book.addOrder(Side::Buy, 102, 10);
+    book.addOrder(Side::Buy, 101, 20);
+    book.addOrder(Side::Buy, 100, 30);
+    book.addOrder(Side::Sell, 99, 15);
+    book.addOrder(Side::Sell, 100, 15);
+    book.addOrder(Side::Sell, 101, 30);
+
+    // ̿ڽ浫ûгɽ
+    EXPECT_EQ(traded, 0);
+    EXPECT_EQ(book.getOrderCount(), 6);
+
+    // 100:  60 /  30 -> 30101:  30 /  60 -> 30ʣͬҷ෴ȡӽο۵ 101
+    AuctionResult indicative = book.getIndicativeUncross(101);
+    EXPECT_EQ(indicative.volume, 30);
+    EXPECT_EQ(indicative.price, 101);
+
+    AuctionResult result = book.uncross(101);
+    EXPECT_EQ(result.price, 101);
+    EXPECT_EQ(result.volume, 30);
+    EXPECT_EQ(traded, 30);
+    EXPECT_EQ(tradePrice, 101);
+    EXPECT_FALSE(book.isInAuction());
+
+    //  102 / 101 ȫɽ 99 / 100 ȫɽ
+    EXPECT_FALSE(book.hasLimit(Side::Buy, 102));
+    EXPECT_FALSE(book.hasLimit(Side::Buy, 101));
+    EXPECT_FALSE(book.hasLimit(Side::Sell, 99));
+    EXPECT_FALSE(book.hasLimit(Side::Sell, 100));
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Buy, 100), 30);
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 101), 30);
+}
+
+// ԣʣȫʱȡ߼
+TEST(OrderBookTest, AuctionBuyPressureTest) {
+    OrderBook book;
+    book.setTradeCallback(nullptr);
+
+    book.startAuction();
+    book.addOrder(Side::Buy, 105, 50);
+    book.addOrder(Side::Sell, 100, 10);
+    book.addOrder(Side::Sell, 103, 10);
+
+    // 103 / 105 ɽ 20ʣ +30ȡ߼ 105
+    AuctionResult result = book.uncross();
+    EXPECT_EQ(result.volume, 20);
+    EXPECT_EQ(result.surplus, 30);
+    EXPECT_EQ(result.price, 105);
+    EXPECT_EQ(book.getVolumeAtPrice(Side::Buy, 105), 30);
+    EXPECT_EQ(book.getOrderCount(), 1);
+}
+
+
+// ԣӳģʽûгϳԿյĵλҲᰴֵѹ
+TEST(OrderBookTest, LazyCompactionWithoutCancelTest) {
+    OrderBook book;
+    book.setTradeCallback(nullptr);
+    book.setLazyCancel(true, 64);
+
+    for (int i = 0; i < 1000; ++i) {
+        book.addOrder(Side::Sell, 1000 + i, 10);
+        book.addOrder(Side::Buy, 1000 + i, 10);
+    }
+
+    EXPECT_EQ(book.getOrderCount(), 0);
+    EXPECT_LT(book.getLevelCount(Side::Sell), 64);
+    EXPECT_EQ(book.getLevelCount(Side::Buy), 0);
+}
+
+
+// ԣۼƳɽ 32 λʱȫϣuncross ̿ڲٽ
+TEST(OrderBookTest, AuctionLargeVolumeTest) {
+    OrderBook book;
+    uint64_t traded = 0;
+
+    book.setTradeCallback([&](const TradeReport& report) {
+        traded += report.quantity;
+        });
+
+    const Quantity big = 2000000000;
+    book.startAuction();
+    for (Price p = 100; p < 103; ++p) {
+        book.addOrder(Side::Buy, p + 10, big);
+        book.addOrder(Side::Sell, p, big);
+    }
+
+    AuctionResult result = book.uncross();
+    EXPECT_EQ(result.volume, 3ULL * big);
+    EXPECT_EQ(traded, 3ULL * big);
+    EXPECT_EQ(book.getOrderCount(), 0);
+
+    auto snapshot = book.getSnapshot(5);
+    if (!snapshot.bids.empty() && !snapshot.asks.empty()) {
+        EXPECT_LT(snapshot.bids[0].price, snapshot.asks[0].price);
+    }
+}
+
+
+// ԣӳģʽĿյλӰ۸
+TEST(OrderBookTest, AuctionIgnoresRetainedLevelsTest) {
+    for (bool lazy : { false, true }) {
+        OrderBook book;
+        book.setTradeCallback(nullptr);
+        book.setLazyCancel(lazy);
+
+        book.startAuction();
+        book.addOrder(Side::Buy, 105, 10);
+        book.addOrder(Side::Sell, 100, 10);
+        OrderId cancelled = book.addOrder(Side::Sell, 103, 10);
+        book.cancelOrder(cancelled);
+
+        AuctionResult result = book.uncross();
+        EXPECT_EQ(result.volume, 10);
+        EXPECT_EQ(result.price, 100);
+    }
+}
+
+
+// ԣɽĶպĹʣඩһ
+TEST(OrderBookTest, AuctionBulkReleaseTest) {
+    // ɽɾɽɨ·Ҫ
+    for (int resting : { 0, 40 }) {
+        OrderBook book;
+        Quantity traded = 0;
+        book.setTradeCallback([&](const TradeReport& report) { traded += report.quantity; });
+        book.setLazyCancel(true);
+
+        book.startAuction();
+        for (int i = 0; i < resting; ++i) book.addOrder(Side::Buy, 90, 1);
+        OrderId s1 = book.addOrder(Side::Sell, 100, 10);
+        OrderId s2 = book.addOrder(Side::Sell, 100, 10);
+        OrderId s3 = book.addIcebergOrder(Side::Sell, 100, 30, 5);
+        OrderId s4 = book.addOrder(Side::Sell, 101, 10);
+        OrderId b1 = book.addOrder(Side::Buy, 105, 40);
+        book.cancelOrder(s2); // ɽλϵĹ
+
+        AuctionResult result = book.uncross();
+        EXPECT_EQ(result.price, 100);
+        EXPECT_EQ(result.volume, 40);
+        EXPECT_EQ(traded, 40);
+        EXPECT_EQ(book.getOrderCount(), static_cast<size_t>(resting) + 1);
+
+        // ѳɽĶЧʣඩԿɳ
+        book.cancelOrder(s1);
+        book.cancelOrder(s3);
+        book.cancelOrder(b1);
+        EXPECT_EQ(book.getOrderCount(), static_cast<size_t>(resting) + 1);
+        book.cancelOrder(s4);
+        EXPECT_EQ(book.getOrderCount(), static_cast<size_t>(resting));
+
+        book.compact();
+        EXPECT_FALSE(book.hasLimit(Side::Sell, 100));
+        EXPECT_FALSE(book.hasLimit(Side::Sell, 101));
+
+        // յĽڵ
+        book.addOrder(Side::Sell, 100, 5);
+        EXPECT_EQ(book.getVolumeAtPrice(Side::Sell, 100), 5);
+    }
+}
@@ -0,0 +1,216 @@
+#include "pch.h"
+#include "gtest/gtest.h"
+#include "OrderBook.h"
+#include "TradeRecorder.h"
+#include <filesystem>
+
+// ԣɽҵ / ¼̨߳д󣬿԰ж
+TEST(TradeRecorderTest, RoundTripColumns) {
+    std::string path = (std::filesystem::temp_directory_path() / "cpp_lob_roundtrip.lobt").string();
+
+    TradeRecorder recorder(1024, 64);
+    ASSERT_TRUE(recorder.open(path));
+
+    OrderBook book;
+    book.setTradeCallback([&](const TradeReport& report) { recorder.recordTrade(report); });
+    book.setBookEventCallback([&](const BookEvent& event) { recorder.recordEvent(event); });
+
+    OrderId maker = book.addOrder(Side::Sell, 100, 10);
+    OrderId taker = book.addOrder(Side::Buy, 100, 4);
+    book.cancelOrder(maker);
+    recorder.close();
+
+    TradeLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(reader.rowCount(), 3);
+
+    auto types = reader.readColumn(LogColumn::Type);
+    EXPECT_EQ(types[0], static_cast<int64_t>(LogEventType::Add));
+    EXPECT_EQ(types[1], static_cast<int64_t>(LogEventType::Trade));
+    EXPECT_EQ(types[2], static_cast<int64_t>(LogEventType::Cancel));
+
+    auto ids = reader.readColumn(LogColumn::OrderId);
+    auto counterIds = reader.readColumn(LogColumn::CounterId);
+    EXPECT_EQ(ids[1], static_cast<int64_t>(maker));
+    EXPECT_EQ(counterIds[1], static_cast<int64_t>(taker));
+
+    auto quantities = reader.readColumn(LogColumn::Quantity);
+    EXPECT_EQ(quantities[0], 10);
+    EXPECT_EQ(quantities[1], 4);
+    EXPECT_EQ(quantities[2], 6);
+
+    reader.close();
+    std::filesystem::remove(path);
+}
+
+// ԣĴɽʽļСڰд洢
+TEST(TradeRecorderTest, ManyBlocksCompress) {
+    std::string path = (std::filesystem::temp_directory_path() / "cpp_lob_blocks.lobt").string();
+    const int trades = 100000;
+
+    {
+        TradeRecorder recorder(256, 4096); // С˳дʱĵȴ·
+        ASSERT_TRUE(recorder.open(path));
+        for (int i = 0; i < trades; ++i) {
+            recorder.recordTrade(TradeReport{ static_cast<OrderId>(1000 + i), static_cast<OrderId>(5000 + i),
+                100000 + (i % 7), static_cast<Quantity>(1 + i % 50), (i % 2) ? Side::Buy : Side::Sell });
+        }
+    } // ʱ close
+
+    TradeLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    ASSERT_EQ(reader.rowCount(), trades);
+
+    int64_t sum = 0;
+    int64_t expected = 0;
+    reader.scanColumn(LogColumn::Price, [&](int64_t price) { sum += price; });
+    for (int i = 0; i < trades; ++i) expected += 100000 + (i % 7);
+    EXPECT_EQ(sum, expected);
+
+    auto ids = reader.readColumn(LogColumn::OrderId);
+    EXPECT_EQ(ids.front(), 1000);
+    EXPECT_EQ(ids.back(), 1000 + trades - 1);
+    reader.close();
+
+    auto fileSize = std::filesystem::file_size(path);
+    EXPECT_LT(fileSize * 3, sizeof(LogRecord) * trades);
+
+    std::filesystem::remove(path);
+}
+
+
+// ԣд;ɱļضʱֻȡݿ
+TEST(TradeRecorderTest, TruncatedFileStopsAtLastCompleteBlock) {
+    std::string path = (std::filesystem::temp_directory_path() / "cpp_lob_truncated.lobt").string();
+    const int trades = 5000;
+    const uint32_t blockRows = 1000;
+
+    {
+        TradeRecorder recorder(1024, blockRows);
+        ASSERT_TRUE(recorder.open(path));
+        for (int i = 0; i < trades; ++i) {
+            recorder.recordTrade(TradeReport{ static_cast<OrderId>(i + 1), 0, 100, 1, Side::Buy });
+        }
+    }
+
+    auto fullSize = std::filesystem::file_size(path);
+
+    // 1. صһĩβ 10 ֽ
+    std::filesystem::resize_file(path, fullSize - 10);
+    {
+        TradeLogReader reader;
+        ASSERT_TRUE(reader.open(path));
+        EXPECT_EQ(reader.rowCount(), trades - blockRows);
+
+        int64_t sum = 0;
+        reader.scanColumn(LogColumn::Quantity, [&](int64_t quantity) { sum += quantity; });
+        EXPECT_EQ(sum, trades - blockRows);
+    }
+
+    // 2. ضļͷ֮ĵһͷм
+    std::filesystem::resize_file(path, 2 * sizeof(uint32_t) + 5);
+    {
+        TradeLogReader reader;
+        ASSERT_TRUE(reader.open(path));
+        EXPECT_EQ(reader.rowCount(), 0);
+        EXPECT_TRUE(reader.readColumn(LogColumn::Price).empty());
+    }
+
+    std::filesystem::remove(path);
+}
+
+
+// ԣûк̨߳ʱδ open /  closeдҲῨס̣߳¼
+TEST(TradeRecorderTest, RecordWithoutWriterDoesNotBlock) {
+    std::string path = (std::filesystem::temp_directory_path() / "cpp_lob_closed.lobt").string();
+    TradeReport report{ 1, 2, 100, 1, Side::Buy };
+
+    TradeRecorder recorder(16, 4);
+    for (int i = 0; i < 17; ++i) EXPECT_FALSE(recorder.recordTrade(report));
+    EXPECT_EQ(recorder.droppedCount(), 17);
+
+    ASSERT_TRUE(recorder.open(path));
+    for (int i = 0; i < 10; ++i) EXPECT_TRUE(recorder.recordTrade(report));
+    recorder.close();
+
+    // رպԹŵĻصԶҲ
+    OrderBook book;
+    book.setTradeCallback([&](const TradeReport& trade) { recorder.recordTrade(trade); });
+    for (int i = 0; i < 100; ++i) {
+        book.addOrder(Side::Sell, 100, 1);
+        book.addOrder(Side::Buy, 100, 1);
+    }
+    EXPECT_EQ(recorder.droppedCount(), 17 + 100);
+
+    TradeLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+    EXPECT_EQ(reader.rowCount(), 10);
+    reader.close();
+
+    std::filesystem::remove(path);
+}
+
+
+// ԣгȺϷ varint λƻʱԽβȡ𻵵Ŀ鶪
+TEST(TradeRecorderTest, CorruptVarintRejectsBlock) {
+    std::string path = (std::filesystem::temp_directory_path() / "cpp_lob_corrupt.lobt").string();
+    const int trades = 3000;
+    const uint32_t blockRows = 1000;
+
+    {
+        TradeRecorder recorder(1024, blockRows);
+        ASSERT_TRUE(recorder.open(path));
+        for (int i = 0; i < trades; ++i) {
+            recorder.recordTrade(TradeReport{ static_cast<OrderId>(i + 1), 0, 100, 1, Side::Buy });
+        }
+    }
+
+    std::vector<uint8_t> bytes(std::filesystem::file_size(path));
+    {
+        std::FILE* in = std::fopen(path.c_str(), "rb");
+        ASSERT_NE(in, nullptr);
+        ASSERT_EQ(std::fread(bytes.data(), 1, bytes.size(), in), bytes.size());
+        std::fclose(in);
+    }
+
+    // λһ飬 OrderId  Quantity ȫĳλֽ
+    uint32_t header[1 + kTradeLogColumns];
+    size_t offset = 2 * sizeof(uint32_t);
+    for (int b = 0; b < trades / static_cast<int>(blockRows) - 1; ++b) {
+        std::memcpy(header, bytes.data() + offset, sizeof(header));
+        offset += sizeof(header);
+        for (size_t c = 0; c < kTradeLogColumns; ++c) offset += header[1 + c];
+    }
+    std::memcpy(header, bytes.data() + offset, sizeof(header));
+    size_t column = offset + sizeof(header);
+    for (size_t c = 0; c < kTradeLogColumns; ++c) {
+        if (c == static_cast<size_t>(LogColumn::OrderId) || c == static_cast<size_t>(LogColumn::Quantity)) {
+            std::memset(bytes.data() + column, 0xFF, header[1 + c]);
+        }
+        column += header[1 + c];
+    }
+
+    {
+        std::FILE* out = std::fopen(path.c_str(), "wb");
+        ASSERT_NE(out, nullptr);
+        std::fwrite(bytes.data(), 1, bytes.size(), out);
+        std::fclose(out);
+    }
+
+    TradeLogReader reader;
+    ASSERT_TRUE(reader.open(path));
+
+    int64_t sum = 0;
+    reader.scanColumn(LogColumn::Quantity, [&](int64_t quantity) { sum += quantity; });
+    EXPECT_EQ(sum, trades - blockRows);
+
+    auto ids = reader.readColumn(LogColumn::OrderId);
+    ASSERT_EQ(ids.size(), trades - blockRows);
+    EXPECT_EQ(ids.back(), trades - blockRows);
+
+    // δƻճ
+    EXPECT_EQ(reader.readColumn(LogColumn::Price).size(), trades);
+    reader.close();
+
+    std::filesystem::remove(path);
+}